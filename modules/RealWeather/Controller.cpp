@@ -7,6 +7,9 @@
 // Include this module's per-player data.
 #include "Data.hpp"
 
+// For `std::min` and `std::max`.
+#include <algorithm>
+
 // For `std::cout` debugging.
 #include <iostream>
 
@@ -66,10 +69,10 @@ bool
 		//   `value<std::string>` - The type of the option.
 		//   `(&realWorldLocation_)` - A reference to the member in which to store the value.
 		//   `"The real...` - A human-friendly description displayed with `--help`.
-		//   `default_value(60)` - The poll rate is optional so a `default_value` is added.
+		//   `default_value(600)` - The poll rate is optional so a `default_value` is added.
 		//
 		("location", boost::program_options::value<std::string>(&realWorldLocation_), "The real location in the world to copy the current weather from.")
-		("pollrate", boost::program_options::value<uint32_t>(&pollRate_)->default_value(60), "How often (in seconds) to check for new weather (default 60).")
+		("pollrate", boost::program_options::value<uint32_t>(&pollRate_)->default_value(600), "How often (in seconds) to re-fetch the weather forecast (default 600).")
 	;
 
 	// This module has options, so return `true`.
@@ -142,13 +145,19 @@ bool
 	RealWeatherController::
 	OnTick(uint32_t elapsedMicroSeconds)
 {
+	// Keep track of how old the cached forecast is.
+	forecastAge_ += elapsedMicroSeconds;
+
 	// Check if `pollrate` seconds have passed.
 	if (CheckElapsedTime(&timeSinceLastPoll_, elapsedMicroSeconds, pollRate_))
 	{
-		// And if so, update the weather.
+		// And if so, fetch a new forecast to correct the cached one.
 		UpdateWeather();
 	}
 
+	// Apply every forecast change that is now due, without going back to the network.
+	ApplyForecast();
+
 	// Check if two seconds have passed.
 	if (CheckElapsedTime(&timeSinceLastFire_, elapsedMicroSeconds, 2))
 	{
@@ -163,20 +172,21 @@ bool
 // Define a helper method to check how much time has passed between two updates.
 bool
 	RealWeatherController::
-	CheckElapsedTime(uint32_t* counter, uint32_t elapsedMicroSeconds, uint32_t threshold) const
+	CheckElapsedTime(uint64_t* counter, uint32_t elapsedMicroSeconds, uint32_t threshold) const
 {
 	// Keep track of time between polls.
 	*counter += elapsedMicroSeconds;
 	
 	// Poll with a frequency given by the `threshold` setting converted from seconds to microseconds.
-	if (*counter < threshold * MICROSECONDS_TO_SECONDS)
+	// 64-bit, since a `uint32_t` count of microseconds wraps after only about 72 minutes.
+	if (*counter < uint64_t{ threshold } * MICROSECONDS_TO_SECONDS)
 	{
 		// Insufficient time has passed.
 		return false;
 	}
 
 	// Adjust down for the next time.  Subtracting instead of resetting reduces jitter.
-	*counter -= threshold * MICROSECONDS_TO_SECONDS;
+	*counter -= uint64_t{ threshold } * MICROSECONDS_TO_SECONDS;
 
 	// Sufficient time has passed.
 	return true;
@@ -186,10 +196,82 @@ void
 	RealWeatherController::
 	UpdateWeather()
 {
-	// Get the current weather in the selected real-world location.
-	std::string
-		newWeather = LookUpRealWorldWeather(realWorldLocation_);
+	// Get the upcoming weather in the selected real-world location.  The library returns a list of
+	// `{ seconds from now, weather name }` pairs, ordered by time, starting with the current weather.
+	auto
+		lookup = LookUpRealWorldForecast(realWorldLocation_);
+
+	// A failed or empty lookup tells us nothing new, so keep using the old forecast, but try again
+	// before it runs out (or soon, if it already has).
+	if (lookup.empty())
+	{
+		SchedulePoll();
+		return;
+	}
+
+	// Apply any old changes due right now first, so replacing the forecast doesn't drop them.
+	ApplyForecast();
+
+	// Replace the old forecast entirely.  Times are relative to this lookup, so restart the clock.
+	forecast_.clear();
+	forecastAge_ = 0;
+	for (auto const & entry : lookup)
+	{
+		// Convert explicitly, and don't let a slightly stale "now" entry wrap round to the far future.
+		forecast_.push_back({ entry.first > 0 ? static_cast<uint32_t>(entry.first) : 0u, entry.second });
+	}
+
+	// Nothing is known past the last change, so don't wait longer than that for the next poll.
+	SchedulePoll();
+
+	// The changes themselves are applied at the right moments by `OnTick`.
+}
+
+// Bring the next poll forward to when the cached forecast runs out, if that is before `pollrate`.
+void
+	RealWeatherController::
+	SchedulePoll()
+{
+	// How long until the last cached change starts.  Zero if the forecast is already used up.
+	uint64_t
+		remaining = 0;
+	if (!forecast_.empty())
+	{
+		uint64_t
+			end = uint64_t{ forecast_.back().Time } * MICROSECONDS_TO_SECONDS;
+		if (end > forecastAge_)
+		{
+			remaining = end - forecastAge_;
+		}
+	}
+
+	// Never poll sooner than `MIN_POLL_SECONDS`, so a very short (or used up) forecast, or a failing
+	// lookup, doesn't cause a lookup every tick.  Never later than `pollrate` either.
+	uint64_t const
+		pollRate = uint64_t{ pollRate_ } * MICROSECONDS_TO_SECONDS;
+	uint64_t
+		wait = std::min(pollRate, std::max(remaining, uint64_t{ MIN_POLL_SECONDS } * MICROSECONDS_TO_SECONDS));
 
+	// The counter counts up to `pollrate`, so start it closer to the threshold.
+	timeSinceLastPoll_ = pollRate - wait;
+}
+
+// Apply, in order, every cached forecast change whose time has now come.
+void
+	RealWeatherController::
+	ApplyForecast()
+{
+	while (!forecast_.empty() && uint64_t{ forecast_.front().Time } * MICROSECONDS_TO_SECONDS <= forecastAge_)
+	{
+		ApplyWeather(forecast_.front().Weather);
+		forecast_.pop_front();
+	}
+}
+
+void
+	RealWeatherController::
+	ApplyWeather(std::string const & newWeather)
+{
 	// Check if the weather has actually changed.
 	if (newWeather == currentRealWeather_)
 	{
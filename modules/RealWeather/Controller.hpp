@@ -12,11 +12,28 @@
 // Include the definition of an fire "entity" (in-game world item).
 #include "Entity.hpp"
 
+// For the cached forecast.
+#include <deque>
+#include <string>
+
 // Define the new event.  Takes a single parameter - the name of the new weather.
 DEFINE_EVENT(OnRealWorldWeatherChange, (std::string const & newWeather));
 
 #define MICROSECONDS_TO_SECONDS (1000000)
 
+// The shortest time (in seconds) to wait before polling again, when the forecast runs out early.
+#define MIN_POLL_SECONDS (60)
+
+// One upcoming weather change from the forecast.
+struct RealWeatherForecastEntry
+{
+	// When this weather starts, in seconds after the lookup that returned it.
+	uint32_t Time;
+
+	// The name of the real-world weather.
+	std::string Weather;
+};
+
 // The main controller class for this module.
 class RealWeatherController
 	// Since there is only one instance of this module, it derives from `SingletonModule` with CRTP.
@@ -45,11 +62,20 @@ private:
 	int ConvertWeatherToID(std::string const & weatherName);
 
 	// Update how many seconds have passed, and check if that passed a threshold
-	bool CheckElapsedTime(uint32_t* counter, uint32_t elapsedMicroSeconds, uint32_t threshold) const;
+	bool CheckElapsedTime(uint64_t* counter, uint32_t elapsedMicroSeconds, uint32_t threshold) const;
 
-	// Update the current real-world weather.
+	// Fetch a new real-world weather forecast.
 	void UpdateWeather();
 
+	// Set when the next poll happens, based on when the cached forecast runs out.
+	void SchedulePoll();
+
+	// Apply all the cached forecast changes that are now due.
+	void ApplyForecast();
+
+	// Switch to a new real-world weather, if it has changed and subscribers accept it.
+	void ApplyWeather(std::string const & newWeather);
+
 	// Refresh fires, as they're explosions that need to be repeatedly re-shown.
 	void UpdateFires();
 
@@ -66,16 +92,24 @@ private:
 
 	// This member keeps track of the number of microseconds since the last poll.  The default means
 	// it will be called instantly.
-	uint32_t
-		timeSinceLastPoll_ = pollRate_ * MICROSECONDS_TO_SECONDS;
+	uint64_t
+		timeSinceLastPoll_ = uint64_t{ pollRate_ } * MICROSECONDS_TO_SECONDS;
+
+	// The upcoming weather changes from the last lookup, ordered by time.  Applied by `OnTick`.
+	std::deque<RealWeatherForecastEntry>
+		forecast_;
+
+	// The number of microseconds since the forecast was fetched.  64-bit, as it is never wrapped.
+	uint64_t
+		forecastAge_ = 0;
 
 	// This member keeps track of the number of microseconds since the last fire refresh.
-	uint32_t
+	uint64_t
 		timeSinceLastFire_ = 2 * MICROSECONDS_TO_SECONDS;
 
 	// This static member stores the number of seconds for the poll rate from settings.
 	static inline uint32_t
-		pollRate_ = 60;
+		pollRate_ = 600;
 
 	// A static variable to store the location in.  Options are global and shared between all
 	// instances of a module (of which there is only one here).